@@ -6,6 +6,9 @@
 #include <cmath>
 #include <chrono>
 #include <ctime>
+#include <cassert>
+#include <vector>
+#include <type_traits>
 
 // openGL variables
 const GLuint numOfVAO = 7;
@@ -58,6 +61,7 @@ enum MenuOption :int {
 	CYAN, MAGENTA, YELLOW,
 	SMALL, MEDIUM, LARGE,
 	SHOW, HIDE,
+	MEMORY_REPORT,
 	EXIT
 };
 enum ClockShape :int {
@@ -77,25 +81,186 @@ enum ClockDigits :int {
 struct coordinate { GLfloat x, y; };
 struct color { GLfloat r, g, b; };
 
+// vertex formats, uploaded to the GPU as described by VertexTraits
+struct FloatVertexFormat {};	// 32-bit float positions and RGB colors
+struct CompactVertexFormat {};	// normalized 16-bit positions and 8-bit RGBA colors
+
+template <typename Format>
+struct VertexTraits;
+
+template <>
+struct VertexTraits<FloatVertexFormat> {
+	typedef coordinate Position;
+	typedef color Color;
+
+	static constexpr GLenum positionType = GL_FLOAT;
+	static constexpr GLboolean positionNormalized = GL_FALSE;
+	static constexpr GLint colorSize = 3;
+	static constexpr GLenum colorType = GL_FLOAT;
+	static constexpr GLboolean colorNormalized = GL_FALSE;
+
+	static Position packPosition(coordinate coord) { return coord; }
+	static Color packColor(color col) { return col; }
+};
+
+template <>
+struct VertexTraits<CompactVertexFormat> {
+	struct Position { GLshort x, y; };
+	struct Color { GLubyte r, g, b, a; };
+
+	static constexpr GLenum positionType = GL_SHORT;
+	static constexpr GLboolean positionNormalized = GL_TRUE;
+	static constexpr GLint colorSize = 4;
+	static constexpr GLenum colorType = GL_UNSIGNED_BYTE;
+	static constexpr GLboolean colorNormalized = GL_TRUE;
+
+	// positions are in normalized device coordinates, so [-1, 1] maps onto the full short range
+	static GLshort packUnit(GLfloat value) {
+		const GLfloat clamped = value < -1.0f ? -1.0f : value > 1.0f ? 1.0f : value;
+		return (GLshort)lround(clamped * 32767.0f);
+	}
+	static GLubyte packByte(GLfloat value) {
+		const GLfloat clamped = value < 0.0f ? 0.0f : value > 1.0f ? 1.0f : value;
+		return (GLubyte)lround(clamped * 255.0f);
+	}
+
+	static Position packPosition(coordinate coord) { return { packUnit(coord.x), packUnit(coord.y) }; }
+	static Color packColor(color col) { return { packByte(col.r), packByte(col.g), packByte(col.b), 255 }; }
+};
+
+// define COMPACT_VERTICES at build time to use the compact vertex format
+#ifdef COMPACT_VERTICES
+typedef VertexTraits<CompactVertexFormat> Vertex;
+#else
+typedef VertexTraits<FloatVertexFormat> Vertex;
+#endif
+
 // constants
 const int window_w = 600, window_h = 600;
-const float PI = 3.14159f;
-const unsigned int numOfClockVertices = 100;
+constexpr float PI = 3.14159f;
+constexpr unsigned int numOfClockVertices = 100;
 const int numOfColors = 4;
-const int numOfHandVertices = 8;
-const int numOfDialVertices = 6;
-const int numOfDigits = 12;
-const int numOfDials = 12;
+constexpr int numOfHandVertices = 8;
+constexpr int numOfDialVertices = 6;
+constexpr int numOfDigits = 12;
+constexpr int numOfDials = 12;
 const int interval = 100;
 const int clockDialIndex = Clock::CLOCK_LENGTH + Hand::HAND_LENGTH;
 
+// compile-time trigonometry, used to generate geometry tables
+constexpr double constSin(double theta) {
+	// wrap theta into [-PI, PI] so the series converges quickly
+	while (theta > PI) theta -= 2.0 * PI;
+	while (theta < -PI) theta += 2.0 * PI;
+
+	double term = theta, sum = theta;
+	for (int n = 1; n < 12; n++) {
+		term *= -theta * theta / ((2.0 * n) * (2.0 * n + 1.0));
+		sum += term;
+	}
+	return sum;
+}
+constexpr double constCos(double theta) {
+	return constSin(theta + PI / 2.0);
+}
+
+// compile-time geometry tables
+template <int N>
+struct CoordinateTable { coordinate vertex[N]; };
+
+template <int N>
+struct DialTable {
+	coordinate offset[N][numOfDialVertices];	// part of dial vertex independent of clock diameter
+	coordinate radial[N][numOfDialVertices];	// part of dial vertex scaled by clock diameter
+};
+
+// unit circle, counter-clockwise from 3 o'clock
+template <int N>
+constexpr CoordinateTable<N> generateUnitCircle() {
+	CoordinateTable<N> table{};
+	for (int i = 0; i < N; i++) {
+		const double theta = 2.0 * PI * i / N;
+		table.vertex[i].x = (GLfloat)constCos(theta);
+		table.vertex[i].y = (GLfloat)constSin(theta);
+	}
+	return table;
+}
+
+// unit direction of each dial, clockwise from 12 o'clock
+template <int N>
+constexpr CoordinateTable<N> generateDialDirections() {
+	CoordinateTable<N> table{};
+	for (int i = 0; i < N; i++) {
+		const double theta = PI / 2.0 - 2.0 * PI * i / N;
+		table.vertex[i].x = (GLfloat)constCos(theta);
+		table.vertex[i].y = (GLfloat)constSin(theta);
+	}
+	return table;
+}
+
+// dial triangles, rotated into place for a clock of diameter 1
+template <int N>
+constexpr DialTable<N> generateDials() {
+	static_assert(N > 0 && N % 4 == 0, "number of dials must place a dial at every quarter hour");
+
+	DialTable<N> table{};
+	const CoordinateTable<N> direction = generateDialDirections<N>();
+
+	for (int i = 0; i < N; i++) {
+		const double c = direction.vertex[i].x;
+		const double s = direction.vertex[i].y;
+		const bool quarter = i % (N / 4) == 0;
+
+		// corners of dial pointing to 12 o'clock, y is scaled by clock diameter
+		const double corner[numOfDialVertices][2] = {
+			// inner part of dial
+			{ -0.01, 0.29 }, { +0.01, 0.29 }, { +0.00, quarter ? 0.20 : 0.25 },
+			// outer part of dial
+			{ -0.01, 0.30 }, { +0.01, 0.30 }, { +0.00, quarter ? 0.36 : 0.32 }
+		};
+
+		for (int j = 0; j < numOfDialVertices; j++) {
+			table.offset[i][j].x = (GLfloat)(corner[j][0] * c);
+			table.offset[i][j].y = (GLfloat)(corner[j][0] * s);
+			table.radial[i][j].x = (GLfloat)(-corner[j][1] * s);
+			table.radial[i][j].y = (GLfloat)(corner[j][1] * c);
+		}
+	}
+	return table;
+}
+
+// hand profile pointing to 3 o'clock for a clock of diameter 1,
+// the tip (last vertex) depends on hand length and is set at runtime
+constexpr CoordinateTable<numOfHandVertices> generateHandProfile() {
+	CoordinateTable<numOfHandVertices> table{};
+
+	// polar coordinates {radius, angle} of each hand vertex
+	const double profile[numOfHandVertices][2] = {
+		// inner part of hand
+		{ 0.08, +0.25 }, { 0.06, 0.00 }, { 0.08, -0.25 }, { 0.00, 0.00 },
+		// outer part of hand
+		{ 0.08, +0.25 }, { 0.10, 0.00 }, { 0.08, -0.25 }, { 0.00, 0.00 }
+	};
+
+	for (int i = 0; i < numOfHandVertices; i++) {
+		table.vertex[i].x = (GLfloat)(profile[i][0] * constCos(profile[i][1]));
+		table.vertex[i].y = (GLfloat)(profile[i][0] * constSin(profile[i][1]));
+	}
+	return table;
+}
+
+constexpr CoordinateTable<numOfClockVertices> unitCircle = generateUnitCircle<numOfClockVertices>();
+constexpr CoordinateTable<numOfDigits> digitDirection = generateDialDirections<numOfDigits>();
+constexpr DialTable<numOfDials> dialTable = generateDials<numOfDials>();
+constexpr CoordinateTable<numOfHandVertices> handProfile = generateHandProfile();
+
 // clock data
-coordinate clockVertex[Clock::CLOCK_LENGTH][numOfClockVertices];
-color clockColorOptions[numOfColors][numOfClockVertices];
-coordinate clockHand[Hand::HAND_LENGTH][numOfHandVertices];
-color clockHandColor[numOfHandVertices];
-coordinate clockDial[numOfDials][numOfDialVertices];
-color clockDialColor[numOfDials * numOfDialVertices];
+Vertex::Position clockVertex[Clock::CLOCK_LENGTH][numOfClockVertices];
+Vertex::Color clockColorOptions[numOfColors][numOfClockVertices];
+Vertex::Position clockHand[Hand::HAND_LENGTH][numOfHandVertices];
+Vertex::Color clockHandColor[numOfHandVertices];
+Vertex::Position clockDial[numOfDials][numOfDialVertices];
+Vertex::Color clockDialColor[numOfDials * numOfDialVertices];
 float clockDiameter = 1.00f;
 
 // clock current option
@@ -209,20 +374,72 @@ GLuint loadShaders(const std::string vShaderFile, const std::string fShaderFile)
 	return programID;
 }
 
+#ifdef _DEBUG
+// check compile-time geometry tables against the runtime math they replace
+void verifyGeometryTables() {
+	const float tolerance = 1e-4f;
+
+	for (int i = 0; i < numOfClockVertices; i++) {
+		const float theta = 2 * PI * i / numOfClockVertices;
+		assert(fabs(unitCircle.vertex[i].x - cos(theta)) < tolerance);
+		assert(fabs(unitCircle.vertex[i].y - sin(theta)) < tolerance);
+	}
+
+	for (int i = 0; i < numOfDigits; i++) {
+		const float theta = PI / 2 - 2 * PI * i / numOfDigits;
+		assert(fabs(digitDirection.vertex[i].x - cos(theta)) < tolerance);
+		assert(fabs(digitDirection.vertex[i].y - sin(theta)) < tolerance);
+	}
+
+	for (int i = 0; i < numOfDials; i++) {
+		const float theta = PI / 2 - 2 * PI * i / numOfDials;
+		const bool quarter = i % (numOfDials / 4) == 0;
+		const float innerTip = quarter ? 0.20f : 0.25f;
+		const float outerTip = quarter ? 0.36f : 0.32f;
+		const coordinate corner[numOfDialVertices] = {
+			{ -0.01f, 0.29f }, { +0.01f, 0.29f }, { +0.00f, innerTip },
+			{ -0.01f, 0.30f }, { +0.01f, 0.30f }, { +0.00f, outerTip }
+		};
+
+		for (int j = 0; j < numOfDialVertices; j++) {
+			const coordinate vertex = {
+				dialTable.offset[i][j].x + dialTable.radial[i][j].x,
+				dialTable.offset[i][j].y + dialTable.radial[i][j].y
+			};
+			assert(fabs(vertex.x - (corner[j].x * cos(theta) - corner[j].y * sin(theta))) < tolerance);
+			assert(fabs(vertex.y - (corner[j].x * sin(theta) + corner[j].y * cos(theta))) < tolerance);
+		}
+	}
+
+	const float handRadius[numOfHandVertices - 1] = { 0.08f, 0.06f, 0.08f, 0.00f, 0.08f, 0.10f, 0.08f };
+	const float handAngle[numOfHandVertices - 1] = { +0.25f, 0.00f, -0.25f, 0.00f, +0.25f, 0.00f, -0.25f };
+	for (int i = 0; i < numOfHandVertices - 1; i++) {
+		assert(fabs(handProfile.vertex[i].x - cos(handAngle[i]) * handRadius[i]) < tolerance);
+		assert(fabs(handProfile.vertex[i].y - sin(handAngle[i]) * handRadius[i]) < tolerance);
+	}
+}
+#endif
+
 void init(void) {
+#ifdef _DEBUG
+	verifyGeometryTables();
+#endif
+
 	// color frame & body color
 	for (int i = 0; i < numOfColors; i++) {
 		for (int j = 0; j < numOfClockVertices; j++) {
 			if (i == 3) {
-				clockColorOptions[i][j] = { (GLfloat)0.7, (GLfloat)0.7, (GLfloat)0.7 };
+				clockColorOptions[i][j] = Vertex::packColor({ (GLfloat)0.7, (GLfloat)0.7, (GLfloat)0.7 });
 			}
 			else {
 				// if i == 0, color is Cyan
 				// if i == 1, color is Magenta
 				// if i == 2, color is Yellow
-				clockColorOptions[i][j].r = (GLfloat)(i == 1 || i == 2 ? 0.85 : 0.3);
-				clockColorOptions[i][j].g = (GLfloat)(i == 2 || i == 0 ? 0.85 : 0.3);
-				clockColorOptions[i][j].b = (GLfloat)(i == 0 || i == 1 ? 0.85 : 0.3);
+				clockColorOptions[i][j] = Vertex::packColor({
+					(GLfloat)(i == 1 || i == 2 ? 0.85 : 0.3),
+					(GLfloat)(i == 2 || i == 0 ? 0.85 : 0.3),
+					(GLfloat)(i == 0 || i == 1 ? 0.85 : 0.3)
+				});
 			}
 		}
 	}
@@ -231,12 +448,12 @@ void init(void) {
 	for (int i = 0; i < numOfHandVertices; i++) {
 		// create gradient color
 		GLfloat handColor = (GLfloat)(i == (numOfHandVertices - 1) ? 0.6 : 0.2);
-		clockHandColor[i] = { handColor, handColor, handColor };
+		clockHandColor[i] = Vertex::packColor({ handColor, handColor, handColor });
 	}
 
 	// clock dial color
 	for (int i = 0; i < numOfDials * numOfDialVertices; i++) {
-		clockDialColor[i] = { 0.4f, 0.4f, 0.4f };
+		clockDialColor[i] = Vertex::packColor({ 0.4f, 0.4f, 0.4f });
 	}
 
 	glGenVertexArrays(numOfVAO, VAO);
@@ -248,13 +465,13 @@ void init(void) {
 		// clock vertices
 		glBindBuffer(GL_ARRAY_BUFFER, VBO[index * 2 + 0]);
 		glBufferData(GL_ARRAY_BUFFER, sizeof(clockVertex[index]), clockVertex[index], GL_STATIC_DRAW);
-		glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+		glVertexAttribPointer(0, 2, Vertex::positionType, Vertex::positionNormalized, sizeof(Vertex::Position), (void*)0);
 		glEnableVertexAttribArray(0);
 		// clock color
 		glBindBuffer(GL_ARRAY_BUFFER, VBO[index * 2 + 1]);
 		glBufferData(GL_ARRAY_BUFFER, sizeof(clockColorOptions), clockColorOptions, GL_STATIC_DRAW);
 		for (int i = 0; i < numOfColors; i++) {
-			glVertexAttribPointer(i + 1, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)((unsigned long long) i * numOfClockVertices * 3 * sizeof(GLfloat)));
+			glVertexAttribPointer(i + 1, Vertex::colorSize, Vertex::colorType, Vertex::colorNormalized, sizeof(Vertex::Color), (void*)((unsigned long long) i * numOfClockVertices * sizeof(Vertex::Color)));
 			glEnableVertexAttribArray(i + 1);
 		}
 	}
@@ -265,12 +482,12 @@ void init(void) {
 		// clock hand vertices
 		glBindBuffer(GL_ARRAY_BUFFER, VBO[(index + Clock::CLOCK_LENGTH) * 2 + 0]);
 		glBufferData(GL_ARRAY_BUFFER, sizeof(clockHand[index]), clockHand[index], GL_DYNAMIC_DRAW);
-		glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+		glVertexAttribPointer(0, 2, Vertex::positionType, Vertex::positionNormalized, sizeof(Vertex::Position), (void*)0);
 		glEnableVertexAttribArray(0);
 		//clock hand color
 		glBindBuffer(GL_ARRAY_BUFFER, VBO[(index + Clock::CLOCK_LENGTH) * 2 + 1]);
-		glBufferData(GL_ARRAY_BUFFER, sizeof(clockHandColor), clockHandColor, GL_DYNAMIC_DRAW);
-		glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+		glBufferData(GL_ARRAY_BUFFER, sizeof(clockHandColor), clockHandColor, GL_STATIC_DRAW);
+		glVertexAttribPointer(1, Vertex::colorSize, Vertex::colorType, Vertex::colorNormalized, sizeof(Vertex::Color), (void*)0);
 		glEnableVertexAttribArray(1);
 	}
 
@@ -279,12 +496,12 @@ void init(void) {
 	glBindVertexArray(VAO[clockDialIndex]);
 	glBindBuffer(GL_ARRAY_BUFFER, VBO[clockDialIndex * 2 + 0]);
 	glBufferData(GL_ARRAY_BUFFER, sizeof(clockDial), clockDial, GL_STATIC_DRAW);
-	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+	glVertexAttribPointer(0, 2, Vertex::positionType, Vertex::positionNormalized, sizeof(Vertex::Position), (void*)0);
 	glEnableVertexAttribArray(0);
 	// clock dial color
 	glBindBuffer(GL_ARRAY_BUFFER, VBO[clockDialIndex * 2 + 1]);
 	glBufferData(GL_ARRAY_BUFFER, sizeof(clockDialColor), clockDialColor, GL_STATIC_DRAW);
-	glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+	glVertexAttribPointer(1, Vertex::colorSize, Vertex::colorType, Vertex::colorNormalized, sizeof(Vertex::Color), (void*)0);
 	glEnableVertexAttribArray(1);
 
 	// program
@@ -296,16 +513,14 @@ void init(void) {
 
 // paint clock FRAME and BODY
 void generateClockVertices(GLfloat x, GLfloat y, GLfloat d, int index) {
-	const float increment = 2 * PI / numOfClockVertices;
-	float theta = 0.0;
-
 	switch (clockShape) {
 	case ClockShape::CIRCLE_SHAPE:
 		// generate circle vertex points
 		for (int i = 0; i < numOfClockVertices; i++) {
-			clockVertex[index][i].x = (cos(theta) * d / 2) + x;
-			clockVertex[index][i].y = (sin(theta) * d / 2) + y;
-			theta += increment;
+			clockVertex[index][i] = Vertex::packPosition({
+				(unitCircle.vertex[i].x * d / 2) + x,
+				(unitCircle.vertex[i].y * d / 2) + y
+			});
 		}
 		break;
 
@@ -333,9 +548,10 @@ void generateClockVertices(GLfloat x, GLfloat y, GLfloat d, int index) {
 				? y + turningCenter
 				: y - turningCenter;
 
-			clockVertex[index][i].x = (cos(theta) * turningVertex) + xOffset;
-			clockVertex[index][i].y = (sin(theta) * turningVertex) + yOffset;
-			theta += increment;
+			clockVertex[index][i] = Vertex::packPosition({
+				(unitCircle.vertex[i].x * turningVertex) + xOffset,
+				(unitCircle.vertex[i].y * turningVertex) + yOffset
+			});
 		}
 		break;
 	}
@@ -382,13 +598,6 @@ void renderBitmapCharacter(int x, int y, void* font, char* string) {
 	glutBitmapString(font, (const unsigned char*)string);
 }
 
-coordinate rotate(coordinate coord, GLfloat theta) {
-	return {
-		coord.x * cos(theta) - coord.y * sin(theta),
-		coord.x * sin(theta) + coord.y * cos(theta)
-	};
-};
-
 void drawDigits() {
 	int digitRadius = 0;
 	coordinate digitOffset = { 0, 0 };
@@ -419,13 +628,9 @@ void drawDigits() {
 		glLoadIdentity();
 		gluOrtho2D(-window_w / 2, window_w / 2, -window_h / 2, window_h / 2);
 
-		const float decrement = (float)(2.0f * PI / numOfDigits);
-		float theta = PI / 2.0;
-
 		for (int i = 0; i < numOfDigits; i++) {
-			int x = (int)(cos(theta) * digitRadius - digitOffset.x);
-			int y = (int)(sin(theta) * digitRadius - digitOffset.y);
-			theta -= decrement;	// decrement instead of increment for clockwise direction
+			int x = (int)(digitDirection.vertex[i].x * digitRadius - digitOffset.x);
+			int y = (int)(digitDirection.vertex[i].y * digitRadius - digitOffset.y);
 			renderBitmapCharacter(x, y, (void*)font, (char*)std::to_string(i == 0 ? 12 : i).c_str());
 		}
 
@@ -438,36 +643,19 @@ void drawDigits() {
 		glBindVertexArray(VAO[clockDialIndex]);
 
 		// clock dial vertices
-		float theta = PI / 2;
-		const float decrement = PI * 2 / numOfDials;
-
 		for (int i = 0; i < numOfDials; i++) {
-			// inner part of dial
-			const coordinate corner1 = { -0.01f, clockDiameter * 0.29f };
-			const coordinate corner2 = { +0.01f, clockDiameter * 0.29f };
-			const coordinate corner3 = { +0.00f, clockDiameter * (i % 3 == 0 ? 0.20f : 0.25f) };
-
-			// outer part of dial
-			const coordinate corner4 = { -0.01f, clockDiameter * 0.30f };
-			const coordinate corner5 = { +0.01f, clockDiameter * 0.30f };
-			const coordinate corner6 = { +0.00f, clockDiameter * (i % 3 == 0 ? 0.36f : 0.32f) };
-
-			clockDial[i][0] = rotate(corner1, theta);
-			clockDial[i][1] = rotate(corner2, theta);
-			clockDial[i][2] = rotate(corner3, theta);
-			clockDial[i][3] = rotate(corner4, theta);
-			clockDial[i][4] = rotate(corner5, theta);
-			clockDial[i][5] = rotate(corner6, theta);
-
-			theta -= decrement;
+			for (int j = 0; j < numOfDialVertices; j++) {
+				clockDial[i][j] = Vertex::packPosition({
+					dialTable.offset[i][j].x + dialTable.radial[i][j].x * clockDiameter,
+					dialTable.offset[i][j].y + dialTable.radial[i][j].y * clockDiameter
+				});
+			}
 		}
 		glBindBuffer(GL_ARRAY_BUFFER, VBO[clockDialIndex * 2 + 0]);
 		glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(clockDial), clockDial);
 
-		// clock dial color
+		// clock dial color, uploaded once in init
 		int uniformLocation = glGetUniformLocation(program, "colorChoice");
-		glBindBuffer(GL_ARRAY_BUFFER, VBO[clockDialIndex * 2 + 1]);
-		glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(clockDialColor), clockDialColor);
 		glUniform1i(uniformLocation, 1);
 		glDrawArrays(GL_TRIANGLES, 0, numOfDials * numOfDialVertices);
 		break;
@@ -503,25 +691,23 @@ void generateHandVertices(int _) {
 				index == Hand::MIN ? 0.60 :
 				index == Hand::HOUR ? 0.50 : 0);
 
-		// inner part of hand
-		clockHand[index][0].x = (GLfloat)(cos(theta + 0.25) * clockDiameter * 0.08);
-		clockHand[index][0].y = (GLfloat)(sin(theta + 0.25) * clockDiameter * 0.08);
-		clockHand[index][1].x = (GLfloat)(cos(theta) * clockDiameter * 0.06);
-		clockHand[index][1].y = (GLfloat)(sin(theta) * clockDiameter * 0.06);
-		clockHand[index][2].x = (GLfloat)(cos(theta - 0.25) * clockDiameter * 0.08);
-		clockHand[index][2].y = (GLfloat)(sin(theta - 0.25) * clockDiameter * 0.08);
-		clockHand[index][3].x = 0;
-		clockHand[index][3].y = 0;
+		// rotate hand profile into place
+		const GLfloat cosTheta = (GLfloat)cos(theta);
+		const GLfloat sinTheta = (GLfloat)sin(theta);
 
-		// outer part of hand
-		clockHand[index][4].x = (GLfloat)(cos(theta + 0.25) * clockDiameter * 0.08);
-		clockHand[index][4].y = (GLfloat)(sin(theta + 0.25) * clockDiameter * 0.08);
-		clockHand[index][5].x = (GLfloat)(cos(theta) * clockDiameter * 0.1);
-		clockHand[index][5].y = (GLfloat)(sin(theta) * clockDiameter * 0.1);
-		clockHand[index][6].x = (GLfloat)(cos(theta - 0.25) * clockDiameter * 0.08);
-		clockHand[index][6].y = (GLfloat)(sin(theta - 0.25) * clockDiameter * 0.08);
-		clockHand[index][7].x = (GLfloat)(cos(theta) * handLength);
-		clockHand[index][7].y = (GLfloat)(sin(theta) * handLength);
+		for (int i = 0; i < numOfHandVertices - 1; i++) {
+			const coordinate vertex = handProfile.vertex[i];
+			clockHand[index][i] = Vertex::packPosition({
+				(vertex.x * cosTheta - vertex.y * sinTheta) * clockDiameter,
+				(vertex.x * sinTheta + vertex.y * cosTheta) * clockDiameter
+			});
+		}
+
+		// tip of hand
+		clockHand[index][numOfHandVertices - 1] = Vertex::packPosition({
+			(GLfloat)(cosTheta * handLength),
+			(GLfloat)(sinTheta * handLength)
+		});
 
 		glBindVertexArray(VAO[index + Clock::CLOCK_LENGTH]);
 		glBindBuffer(GL_ARRAY_BUFFER, VBO[(index + Clock::CLOCK_LENGTH) * 2]);
@@ -535,8 +721,6 @@ void generateHandVertices(int _) {
 void drawHand(int index) {
 	int uniformLocation = glGetUniformLocation(program, "colorChoice");
 	glBindVertexArray(VAO[index + Clock::CLOCK_LENGTH]);
-	glBindBuffer(GL_ARRAY_BUFFER, VBO[(index + Clock::CLOCK_LENGTH) + 1]);
-	glBufferSubData(GL_ARRAY_BUFFER, 1, sizeof(clockHandColor), clockHandColor);
 	glUniform1i(uniformLocation, 1);
 
 	glDrawArrays(GL_QUADS, 0, numOfClockVertices);
@@ -569,6 +753,103 @@ void display(void) {
 	glFlush();
 }
 
+// memory report
+template <typename Traits>
+void reportVertexFormat(const char* name) {
+	const int uploads = 1000;
+
+	const size_t numOfPositions =
+		Clock::CLOCK_LENGTH * numOfClockVertices
+		+ Hand::HAND_LENGTH * numOfHandVertices
+		+ numOfDials * numOfDialVertices;
+	const size_t numOfVertexColors =
+		Clock::CLOCK_LENGTH * numOfColors * numOfClockVertices
+		+ Hand::HAND_LENGTH * numOfHandVertices
+		+ numOfDials * numOfDialVertices;
+
+	// bytes of vertex data held on the GPU for one clock,
+	// positions are re-uploaded while the clock runs, colors only once in init
+	const size_t positionBytes = numOfPositions * sizeof(typename Traits::Position);
+	const size_t colorBytes = numOfVertexColors * sizeof(typename Traits::Color);
+
+	// float geometry of one clock at the current diameter, as generated before packing
+	std::vector<coordinate> geometry;
+	const GLfloat diameters[Clock::CLOCK_LENGTH] = { 1.00f, 0.80f, 0.75f };
+	for (int index = 0; index < Clock::CLOCK_LENGTH; index++) {
+		for (int i = 0; i < numOfClockVertices; i++) {
+			geometry.push_back({
+				unitCircle.vertex[i].x * clockDiameter * diameters[index] / 2,
+				unitCircle.vertex[i].y * clockDiameter * diameters[index] / 2
+			});
+		}
+	}
+	for (int index = 0; index < Hand::HAND_LENGTH; index++) {
+		for (int i = 0; i < numOfHandVertices; i++) {
+			geometry.push_back({ handProfile.vertex[i].x * clockDiameter, handProfile.vertex[i].y * clockDiameter });
+		}
+	}
+	for (int i = 0; i < numOfDials; i++) {
+		for (int j = 0; j < numOfDialVertices; j++) {
+			geometry.push_back({
+				dialTable.offset[i][j].x + dialTable.radial[i][j].x * clockDiameter,
+				dialTable.offset[i][j].y + dialTable.radial[i][j].y * clockDiameter
+			});
+		}
+	}
+
+	std::vector<typename Traits::Position> positions(numOfPositions);
+	std::vector<typename Traits::Color> colors(numOfVertexColors, Traits::packColor({ 0.4f, 0.4f, 0.4f }));
+
+	GLuint buffer[2];
+	glGenBuffers(2, buffer);
+	glBindBuffer(GL_ARRAY_BUFFER, buffer[0]);
+	glBufferData(GL_ARRAY_BUFFER, positionBytes, NULL, GL_DYNAMIC_DRAW);
+	glFinish();
+
+	// time per clock work done while the clock runs: pack positions, then upload them
+	std::chrono::duration<double, std::micro> packTime(0), uploadTime(0);
+	for (int n = 0; n < uploads; n++) {
+		const auto packStart = std::chrono::high_resolution_clock::now();
+		for (size_t i = 0; i < numOfPositions; i++) {
+			positions[i] = Traits::packPosition(geometry[i]);
+		}
+		const auto uploadStart = std::chrono::high_resolution_clock::now();
+		glBufferSubData(GL_ARRAY_BUFFER, 0, positionBytes, positions.data());
+		glFinish();
+		const auto uploadEnd = std::chrono::high_resolution_clock::now();
+
+		packTime += uploadStart - packStart;
+		uploadTime += uploadEnd - uploadStart;
+	}
+
+	// time the one-off color upload, as done in init
+	glBindBuffer(GL_ARRAY_BUFFER, buffer[1]);
+	const auto colorStart = std::chrono::high_resolution_clock::now();
+	glBufferData(GL_ARRAY_BUFFER, colorBytes, colors.data(), GL_STATIC_DRAW);
+	glFinish();
+	const auto colorEnd = std::chrono::high_resolution_clock::now();
+	glDeleteBuffers(2, buffer);
+
+	const double colorMicroseconds = std::chrono::duration<double, std::micro>(colorEnd - colorStart).count();
+
+	std::cout << name << std::endl;
+	std::cout << "  position: " << sizeof(typename Traits::Position) << " bytes/vertex, "
+		<< "color: " << sizeof(typename Traits::Color) << " bytes/vertex" << std::endl;
+	std::cout << "  footprint per clock: " << positionBytes + colorBytes << " bytes "
+		<< "(" << positionBytes << " position + " << colorBytes << " color)" << std::endl;
+	std::cout << "  re-uploaded per clock: " << positionBytes << " bytes" << std::endl;
+	std::cout << "  position pack time per clock: " << packTime.count() / uploads << " us" << std::endl;
+	std::cout << "  position upload time per clock: " << uploadTime.count() / uploads << " us" << std::endl;
+	std::cout << "  color upload time per clock (once): " << colorMicroseconds << " us" << std::endl;
+}
+
+void reportVertexMemory() {
+	std::cout << "Vertex memory report (in use: "
+		<< (std::is_same<Vertex, VertexTraits<CompactVertexFormat>>::value ? "compact" : "float") << ")" << std::endl;
+	reportVertexFormat<VertexTraits<FloatVertexFormat>>("float vertex format");
+	reportVertexFormat<VertexTraits<CompactVertexFormat>>("compact vertex format");
+}
+
 // menu
 void processMenuEvents(int option) {
 	switch (static_cast<MenuOption>(option)) {
@@ -613,6 +894,11 @@ void processMenuEvents(int option) {
 		clockDigits = ClockDigits::HIDE_DIGITS;
 		break;
 
+		// memory report
+	case MenuOption::MEMORY_REPORT:
+		reportVertexMemory();
+		break;
+
 		// exit
 	case MenuOption::EXIT:
 		exit(0);
@@ -651,6 +937,7 @@ void createMenu() {
 	glutAddSubMenu("Color", clockColorMenu);
 	glutAddSubMenu("Size", clockSizeMenu);
 	glutAddSubMenu("Digits", clockDigitsMenu);
+	glutAddMenuEntry("Memory Report", MenuOption::MEMORY_REPORT);
 	glutAddMenuEntry("Exit", MenuOption::EXIT);
 
 	glutAttachMenu(GLUT_RIGHT_BUTTON);